@@ -99,9 +99,11 @@ SOURCES      := utility/src/align/align-ksw2-driver.C \
                 stores/ovStoreFilter.C \
                 stores/ovStoreFile.C \
                 stores/ovStoreHistogram.C \
+                stores/ovTextReader.C \
                 \
                 stores/tgStore.C \
                 stores/tgTig.C \
+                stores/tgTigBAMWriter.C \
                 stores/tgTigSizeAnalysis.C \
                 stores/tgTigMultiAlignDisplay.C \
                 \
@@ -490,25 +490,17 @@ sub consensusLoad ($) {
 
     if ((getGlobal("bamOutput") eq "1") &&
         (! fileExists("$asm.contigs.bam"))) {
-        my $samtools = getGlobal("samtools");
-
         $cmd  = "$bin/tgTigDisplay \\\n";
         $cmd .= "  -S ../$asm.seqStore \\\n";
         $cmd .= "  -b \\\n";
-        $cmd .= "  -o ../$asm.contigs.unsorted.bam \\\n";
+        $cmd .= "  -o ../$asm.contigs.bam \\\n";
         $cmd .= "  -L ./5-consensus/ctgcns.files \\\n";
         $cmd .= "> ./5-consensus/ctgcns.files.contigs.bam.err 2>&1";
-      
+
         if (runCommand("unitigging", $cmd)) {
             caExit("failed to extract BAM records from ctgcns files", "$path/ctgcns.files.contigs.bam.err");
         }
         unlink "$path/ctgcns.files.contigs.bam.err";
-
-        if (runCommand(".", "$samtools sort --write-index --threads 2 -o ./$asm.contigs.bam ./$asm.contigs.unsorted.bam > ./ctgcns.bam.err 2>&1")) {
-            caExit("failed to sort BAM outputs from ./$asm.contigs.unsorted.bam to ./$asm.contigs.bam", "./ctgcns.bam.err");
-        }
-        unlink "./$asm.contigs.unsorted.bam";
-        unlink "./ctgcns.bam.err";
     }
 
     #  Remove consensus outputs
@@ -130,6 +130,7 @@ sub buildCorrectionLayoutsConfigure ($) {
     $cmd .= "  -eE " . getGlobal("corMaxEvidenceErate")  . " \\\n"  if (defined(getGlobal("corMaxEvidenceErate")));
     $cmd .= "  -eC " . getCorCov($asm, "Local") . " \\\n";
     $cmd .= "  -xC " . getCorCov($asm, "Global") . " \\\n";
+    $cmd .= "  -threads " . getGlobal("executiveThreads") . " \\\n";
     $cmd .= "> ./$asm.corStore.err 2>&1";
 
     if (runCommand($base, $cmd)) {
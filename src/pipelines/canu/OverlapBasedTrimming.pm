@@ -62,6 +62,7 @@ sub trimReads ($) {
     #$cmd .= "  -Cm ./$asm.max.clear \\\n"          if (-e "./$asm.max.clear");
     $cmd .= "  -ol " . getGlobal("trimReadsOverlap") . " \\\n";
     $cmd .= "  -oc " . getGlobal("trimReadsCoverage") . " \\\n";
+    $cmd .= "  -threads " . getGlobal("executiveThreads") . " \\\n";
     $cmd .= "  -o  ./$asm.1.trimReads \\\n";
     $cmd .= ">     ./$asm.1.trimReads.err 2>&1";
 
@@ -134,6 +135,7 @@ sub splitReads ($) {
     $cmd .= "  -Co ./$asm.2.splitReads.clear \\\n";
     $cmd .= "  -e  $erate \\\n";
     $cmd .= "  -minlength " . getGlobal("minReadLength") . " \\\n";
+    $cmd .= "  -threads " . getGlobal("executiveThreads") . " \\\n";
     $cmd .= "  -o  ./$asm.2.splitReads \\\n";
     $cmd .= ">     ./$asm.2.splitReads.err 2>&1";
 
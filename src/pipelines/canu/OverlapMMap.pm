@@ -394,6 +394,7 @@ sub mmapConfigure ($$$) {
     print F "     ! -e ./results/\$qry.ovb ] ; then\n";
     print F "  \$bin/mmapConvert \\\n";
     print F "    -S ../../$asm.seqStore \\\n";
+    print F "    -threads ", getGlobal("${tag}mmapThreads"), " \\\n";
     print F "    -o ./results/\$qry.mmap.ovb.WORKING \\\n";
     print F "    -e " . getGlobal("${tag}OvlErrorRate");
     print F "    -partial \\\n"  if ($typ eq "partial");
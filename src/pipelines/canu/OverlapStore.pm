@@ -275,6 +275,15 @@ sub createOverlapStoreParallel ($$$$$$) {
             print F "\n";
         }
 
+        #  The bucketizer -M limits only its overlap buffers.  Leave a quarter
+        #  of the job memory, and at least half a GB, for the seqStore, config
+        #  and everything else.
+
+        my $ovbBuffers = getGlobal("ovbMemory") * 0.75;
+
+        $ovbBuffers = getGlobal("ovbMemory") - 0.5    if ($ovbBuffers > getGlobal("ovbMemory") - 0.5);
+        $ovbBuffers = 0.25                            if ($ovbBuffers < 0.25);
+
         print F "#\n";
         print F "#  Bucketize!\n";
         print F "#\n";
@@ -285,6 +294,8 @@ sub createOverlapStoreParallel ($$$$$$) {
         print F "  -S ../$asm.seqStore \\\n";
         print F "  -C  ./$asm.ovlStore.config \\\n";
         print F "  -f \\\n";
+        print F "  -threads " . getGlobal("ovbThreads") . " \\\n";
+        print F "  -M $ovbBuffers \\\n";
         print F "  -b \$jobid \n";
         print F "\n";
 
@@ -881,10 +892,20 @@ sub createOverlapStore ($$) {
     fetchFile("$base/$asm.ovlStore.config");
     fetchFile("$base/$asm.ovlStore.config.txt");
 
+    #  When the store is built on this machine, let ovStoreConfig plan the
+    #  slices and sort jobs for the cores and memory we're allowed to use.
+    #  On the grid, the number of concurrent jobs isn't known, so just use
+    #  as few slices as ovsMemory allows.
+
+    my $ovsLocal = ((!defined(getGlobal("gridEngine"))) ||
+                    (getGlobal("useGrid")    ne "1") ||
+                    (getGlobal("useGridOVS") ne "1"));
+
     if (! -e "$base/$asm.ovlStore.config") {
         $cmd  = "$bin/ovStoreConfig \\\n";
         $cmd .= " -S ../$asm.seqStore \\\n";
         $cmd .= " -M " . getGlobal("ovsMemory") . " \\\n";    #  User supplied memory limit, reset below
+        $cmd .= " -plan -threads " . getGlobal("maxThreads") . " -memory " . getGlobal("maxMemory") . " \\\n"   if ($ovsLocal);
         $cmd .= " -L ./1-overlapper/ovljob.files \\\n";
         $cmd .= " -create ./$asm.ovlStore.config \\\n";
         $cmd .= " > ./$asm.ovlStore.config.txt \\\n";
@@ -921,12 +942,14 @@ sub createOverlapStore ($$) {
     my $numBuckets = 0;
     my $numSlices  = 0;
     my $sortMemory = 0;
+    my $sortJobs   = 0;
 
     open(F, "< $base/$asm.ovlStore.config.txt") or caExit("can't open '$base/$asm.ovlStore.config.txt' for reading: $!\n", undef);
     while (<F>) {
         $numBuckets = $1  if (m/numBuckets\s+(\d+)/);
         $numSlices  = $1  if (m/numSlices\s+(\d+)/);
         $sortMemory = $1  if (m/sortMemory\s+(\d+)\s+GB/);
+        $sortJobs   = $1  if (m/sortJobs\s+(\d+)/);
     }
     close(F);
 
@@ -935,9 +958,19 @@ sub createOverlapStore ($$) {
     printf STDERR "--   %4d bucket%s\n", $numBuckets, ($numBuckets == 1) ? "" : "s";
     printf STDERR "--   %4d slice%s\n",  $numSlices,  ($numSlices  == 1) ? "" : "s";
     printf STDERR "--        using at most %d GB memory each\n", $sortMemory;
+    printf STDERR "--   %4d sort job%s at a time\n", $sortJobs, ($sortJobs == 1) ? "" : "s"   if ($sortJobs > 0);
 
     setGlobal("ovsMemory", $sortMemory + 2);  #  Actual memory usage of sort jobs (rounded up).
 
+    #  If planned, run no more sort jobs at once than the plan expects.
+
+    if (($sortJobs > 0) &&
+        ((!defined(getGlobal("ovsConcurrency"))) ||
+         (getGlobal("ovsConcurrency") == 0) ||
+         (getGlobal("ovsConcurrency") > $sortJobs))) {
+        setGlobal("ovsConcurrency", $sortJobs);
+    }
+
     #  If only one slice, do it all in core, otherwise, use the big gun and run it in parallel.
 
     if ($numSlices == 1) {
@@ -968,6 +1001,7 @@ sub createOverlapStore ($$) {
         $cmd .= " -S ../$asm.seqStore \\\n";
         $cmd .= " -O  ./$asm.ovlStore \\\n";
         $cmd .= " -o  ./$asm.ovlStore \\\n";
+        $cmd .= " -threads " . getGlobal("executiveThreads") . " \\\n";
         $cmd .= " > ./$asm.ovlStore.summary.err 2>&1";
 
         if (runCommand($base, $cmd)) {
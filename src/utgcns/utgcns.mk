@@ -5,7 +5,8 @@ SOURCES  := utgcns.C \
             unitigPartition.C \
             utgcns-parameters.C \
             utgcns-processTigs.C \
-            libpbutgcns/AlnGraphBoost.C
+            libpbutgcns/AlnGraphBoost.C \
+            libpbutgcns/AlnGraphFlat.C
 
 
 ifeq (${OSTYPE}, Linux)